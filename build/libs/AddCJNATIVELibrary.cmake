@@ -365,6 +365,7 @@ make_cangjie_lib(
         logger
         net.tls.common
         crypto.common
+        compress.zlib
     CANGJIE_STD_LIB_LINK
         std-core
         std-sync
@@ -60,7 +60,8 @@ set(NET_HTTP_DEPENDENCIES
     cangjie${BACKEND_TYPE}Log
     cangjie${BACKEND_TYPE}Logger
     cangjie${BACKEND_TYPE}TlsCommon
-    cangjie${BACKEND_TYPE}CryptoCommon)
+    cangjie${BACKEND_TYPE}CryptoCommon
+    cangjie${BACKEND_TYPE}ZLIB)
 
 set(UNITTEST_DATA_DEPENDENCIES
     cangjie${BACKEND_TYPE}Serialization
@@ -60,7 +60,8 @@ set(NET_HTTP_DEPENDENCIES
     cangjie${BACKEND_TYPE}Log_bc
     cangjie${BACKEND_TYPE}Logger_bc
     cangjie${BACKEND_TYPE}TlsCommon_bc
-    cangjie${BACKEND_TYPE}CryptoCommon_bc)
+    cangjie${BACKEND_TYPE}CryptoCommon_bc
+    cangjie${BACKEND_TYPE}ZLIB_bc)
 
 set(UNITTEST_DATA_DEPENDENCIES
     cangjie${BACKEND_TYPE}Serialization_bc
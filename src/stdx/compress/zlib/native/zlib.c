@@ -57,6 +57,11 @@ extern int CJ_ZlibStreamEncode(z_stream* zlibStream, int flushType)
     return deflate(zlibStream, flushType);
 }
 
+extern int CJ_ZlibStreamEncodeReset(z_stream* zlibStream)
+{
+    return deflateReset(zlibStream);
+}
+
 extern int CJ_ZlibStreamEncodeFini(z_stream* zlibStream)
 {
     return deflateEnd(zlibStream);